@@ -39,13 +39,16 @@
 #include "matstatus.h"
 #include "mixedgradientpressurebc.h"
 #include "floatmatrix.h"
+#include "stepsharedvalue.h"
 
 #include <memory>
+#include <atomic>
 
 ///@name Input fields for FE^2 fluid material
 //@{
 #define _IFT_FE2FluidMaterial_Name "fe2fluidmaterial"
 #define _IFT_FE2FluidMaterial_fileName "inputfile"
+#define _IFT_FE2FluidMaterial_sharedTangent "sharedtangent"
 //@}
 
 namespace oofem {
@@ -87,7 +90,10 @@ public:
     MixedGradientPressureBC *giveBC() { return this->bc; }
 
     void markOldTangents();
+    bool hasOldTangents() const { return this->oldTangents; }
     void computeTangents(TimeStep *tStep);
+    /// Sets the tangents computed elsewhere (e.g. on identical RVE), marks them as up to date.
+    void letTangentsBe(const FloatMatrix &ed, const FloatArray &ep, const FloatArray &cd, double cp);
 
     double giveVOFFraction() { return this->voffraction; }
 
@@ -131,7 +137,24 @@ class FE2FluidMaterial : public FluidDynamicMaterial
 {
 private:
     std :: string inputfile;
-    static int n;
+    static std :: atomic< int >n;
+
+    /**
+     * If set, the RVE response is assumed to be linear, and the same for all integration points,
+     * so the tangents are computed only once per time step and shared by all integration points.
+     */
+    bool sharedTangent = false;
+    /// Tangents shared by all integration points (deviatoric, deviatoric-pressure, volumetric-deviatoric, volumetric-pressure).
+    struct SharedTangents {
+        FloatMatrix Ed;
+        FloatArray Ep, Cd;
+        double Cp = 0.;
+    };
+    /// Shared tangents, evaluated once per time step.
+    mutable StepSharedValue< SharedTangents >sharedTangentValue;
+
+    /// Makes sure that tangents in given status are up to date, using the shared tangents if enabled.
+    void giveUpdatedTangents(FE2FluidMaterialStatus *ms, TimeStep *tStep) const;
 
 public:
     /**
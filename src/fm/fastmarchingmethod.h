@@ -37,10 +37,11 @@
 
 #include "floatarray.h"
 #include "mathfem.h"
+#include "heap.h"
 
 #include <vector>
 #include <list>
-#include <queue>
+#include <memory>
 
 namespace oofem {
 class Domain;
@@ -49,6 +50,10 @@ class Domain;
  * Fast Marching Method for unstructured grids.
  * Used to solve Eikonal equation and especially to construct
  * signed distance function.
+ * The trial set is kept in an indexed binary heap (see Heap), so that the trial
+ * values can be decreased in place. Optionally, the front can be stopped at given
+ * distance from the boundary (narrow band), so that only the nodes close to the
+ * boundary are processed.
  */
 class FastMarchingMethod
 {
@@ -70,27 +75,17 @@ public:
 
     /// Array of DofManager records.
     std :: vector< FMM_DofmanRecord >dmanRecords;
-    /// Pointer to working set of dmanValues.
-    const FloatArray *dmanValuesPtr;
-    // Delegate of FMM_DofmanRecord; stored in priority queue.
-    //class FMM_DofmanRecordDelegate {
-    //public:FMM_DofmanRecordDelegaFMM_DofmanRecordDelegatete
-    //  int id;
-    //};
-
-    struct FMM_DofmanRecordDelegate_greater {
-        const FloatArray **dmanValuesPtrRef;
-        FMM_DofmanRecordDelegate_greater(const FloatArray **dv) : dmanValuesPtrRef(dv)
-        { }
-        bool operator() (const int & p, const int & q) const
-        { return ( fabs( ( * dmanValuesPtrRef )->at(p) ) > fabs( ( * dmanValuesPtrRef )->at(q) ) ); }
-    };
 
     /// Domain.
     Domain *domain;
 
-    /// Priority queue for trial T values.
-    std :: priority_queue< int, std :: vector< int > , FMM_DofmanRecordDelegate_greater >dmanTrialQueue;
+    /// Heap of trial nodes, ordered by absolute value of T (indexed by node number - 1).
+    std :: unique_ptr< Heap >trialHeap;
+    /// Size of trialHeap index space.
+    int trialHeapSize;
+
+    /// Node to node connectivity in compressed row format; neighbors of node i are nodeNeighbors[nodeNeighborPtr[i-1]..nodeNeighborPtr[i]-1].
+    std :: vector< int >nodeNeighborPtr, nodeNeighbors;
 
 public:
     /**
@@ -98,9 +93,7 @@ public:
      * FastMarchingMethod material interface instance with given number and belonging to given domain.
      * @param d Domain to which component belongs to.
      */
-    FastMarchingMethod(Domain * d) : dmanTrialQueue( FMM_DofmanRecordDelegate_greater(& this->dmanValuesPtr) ) {
-        domain = d;
-    }
+    FastMarchingMethod(Domain * d) : domain(d), trialHeapSize(0) { }
 
     /**
      * Solution of problem.
@@ -112,8 +105,11 @@ public:
      * will not propagate from this dofman (usefull, when one needs to construct
      * "one sided" solution).
      * @param F is the front propagation speed.
+     * @param bandWidth If positive, the front is stopped once the absolute value of T exceeds bandWidth.
+     * Values of nodes remaining in trial set are then set to sgn(T)*bandWidth, values of
+     * far nodes are left unchanged.
      */
-    void solve(FloatArray &dmanValues, const std :: list< int > &bcDofMans, double F);
+    void solve(FloatArray &dmanValues, const std :: list< int > &bcDofMans, double F, double bandWidth = 0.);
 
     // identification
     const char *giveClassName() const { return "FastMarchingMethod"; }
@@ -122,6 +118,9 @@ protected:
     /// Initialize receiver.
     void initialize(FloatArray &dmanValues, const std :: list< int > &bcDofMans, double F);
 
+    /// Builds node to node connectivity (nodeNeighborPtr, nodeNeighbors), if not already available.
+    void buildNodeNeighbors();
+
     /// Updates the distance of trial node with given id).
     void updateTrialValue(FloatArray &dmanValues, int id, double F);
 
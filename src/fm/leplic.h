@@ -39,6 +39,7 @@
 #include "floatarray.h"
 #include "mathfem.h"
 #include "interface.h"
+#include "geotoolbox.h"
 
 ///@name Input fields for LEPLIC
 //@{
@@ -47,9 +48,18 @@
 
 namespace oofem {
 class LEPlic;
-class Polygon;
 class Element;
 
+/**
+ * Work storage for LEPlicElementInterface::truncateMatVolume.
+ * Each thread keeps its own instance, so the polygons are not reallocated for every truncation.
+ */
+struct LEPlicTruncationScratch
+{
+    Polygon me, clip;
+    Graph g;
+};
+
 /**
  * Element interface for LEPlic class representing Lagrangian-Eulerian (moving) material interface.
  * The elements should provide specific functionality in order to collaborate with LEPlic and this
@@ -80,8 +90,8 @@ public:
     /// Assembles receiver material polygon based solely on given interface line.
     virtual void formVolumeInterfacePoly(Polygon &matvolpoly, LEPlic *matInterface,
                                          const FloatArray &normal, const double p, bool updFlag) = 0;
-    /// Truncates given material polygon to receiver.
-    virtual double truncateMatVolume(const Polygon &matvolpoly, double &volume) = 0;
+    /// Truncates given material polygon to receiver, using the given work storage.
+    virtual double truncateMatVolume(const Polygon &matvolpoly, double &volume, LEPlicTruncationScratch &scratch) = 0;
     /// Computes the receiver center (in updated Lagrangian configuration).
     virtual void giveElementCenter(LEPlic *mat_interface, FloatArray &center, bool updFlag) = 0;
     /// Assembles receiver volume.
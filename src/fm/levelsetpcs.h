@@ -38,6 +38,7 @@
 #include "materialinterface.h"
 #include "geotoolbox.h"
 #include "interface.h"
+#include "fastmarchingmethod.h"
 
 #include <vector>
 
@@ -49,6 +50,7 @@
 #define _IFT_LevelSetPCS_reinit_dt "rdt"
 #define _IFT_LevelSetPCS_reinit_err "rerr"
 #define _IFT_LevelSetPCS_reinit_alg "lsra"
+#define _IFT_LevelSetPCS_fmm_band "fmmband"
 #define _IFT_LevelSetPCS_nsd "nsd"
 #define _IFT_LevelSetPCS_ci1 "ci1"
 #define _IFT_LevelSetPCS_ci2 "ci2"
@@ -129,6 +131,10 @@ protected:
     bool reinit_dt_flag;
     /// Reinitialization error limit.
     double reinit_err;
+    /// Width of narrow band used by fast marching reinitialization (zero for whole domain).
+    double fmm_band;
+    /// Fast marching solver used by FMM reinitialization.
+    FastMarchingMethod fmm;
     /// number of spatial dimensions.
     int nsd;
     /// Level set values version.
@@ -146,7 +152,7 @@ public:
      *  node number in particular domain.
      *  @param d Domain to which component belongs to.
      */
-    LevelSetPCS(int n, Domain * d) : MaterialInterface(n, d) {
+    LevelSetPCS(int n, Domain * d) : MaterialInterface(n, d), fmm(d) {
         initialRefMatFlag = false;
         reinit_dt_flag = false;
         levelSetVersion = 0;
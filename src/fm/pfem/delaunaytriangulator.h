@@ -43,6 +43,7 @@
 #define delaunaytrinagulator_h
 
 #include <list>
+#include <unordered_map>
 #include "contextioresulttype.h"
 #include "timer.h"
 #include "octreelocalizert.h"
@@ -92,6 +93,8 @@ protected:
 
     /// contains all edges of the triangulation
     std :: list< AlphaEdge2D * >edgeList;
+    /// Maps the node pair of each edge in edgeList to the edge, allowing constant time lookup
+    std :: unordered_map< long long, AlphaEdge2D * >edgeMap;
 
     /// Octree with Delaunay triangles allowing fast search
     OctreeSpatialLocalizerT< DelaunayTriangle * >triangleOctree;
@@ -118,9 +121,13 @@ private:
     void computeAlphaComplex();
 
     /**
-     * Fills the edgeList with unique alphaEdges. If an edge is already contained a pointer to it is returned and inserted edge is removed.
+     * Returns a pointer to the edge in edgeList connecting the same nodes as alphaEdge, or nullptr if there is no such edge.
      */
     AlphaEdge2D *giveBackEdgeIfAlreadyContainedInList(AlphaEdge2D &alphaEdge);
+    /// Appends a new unique edge to edgeList and registers it for lookup
+    void addEdgeToList(AlphaEdge2D *alphaEdge);
+    /// Returns the lookup key of the edge between two nodes, independent of their order
+    long long giveEdgeKey(int node1, int node2) const;
 
     /// Iterates through the edgeList container and compares alpha-value with alphaEdge bounds. Alpha shape is stored in the alphaShapeEdgeList
     void giveAlphaShape();
@@ -51,6 +51,12 @@ class Tet1_3D_SUPG : public SUPGElement2, public LevelSetPCSElementInterface
 {
 protected:
     static FEI3dTetLin interpolation;
+    /// Shape function derivatives with respect to global coordinates, constant over the element.
+    FloatMatrix dN;
+    /// Jacobian of the mapping to the reference element.
+    double detJ;
+    /// Flag indicating that dN and detJ have been evaluated.
+    bool geometryInitialized;
 
 public:
     Tet1_3D_SUPG(int n, Domain * d);
@@ -83,6 +89,8 @@ public:
 
 protected:
     void computeGaussPoints() override;
+    /// Returns the shape function derivatives, which are evaluated once and kept.
+    const FloatMatrix &giveDNdx();
     void computeDeviatoricStress(FloatArray &answer, const FloatArray &eps, GaussPoint *gp, TimeStep *tStep) override;
     void computeTangent(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) override;
     void computeNuMatrix(FloatMatrix &answer, GaussPoint *gp) override;
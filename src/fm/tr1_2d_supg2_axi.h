@@ -135,7 +135,7 @@ protected:
                                 const FloatArray &normal, const double p, bool updFlag) override;
     void formVolumeInterfacePoly(Polygon &matvolpoly, LEPlic *matInterface,
                                  const FloatArray &normal, const double p, bool updFlag) override;
-    double truncateMatVolume(const Polygon &matvolpoly, double &volume) override;
+    double truncateMatVolume(const Polygon &matvolpoly, double &volume, LEPlicTruncationScratch &scratch) override;
     void giveElementCenter(LEPlic *mat_interface, FloatArray &center, bool updFlag) override;
     void formMyVolumePoly(Polygon &myPoly, LEPlic *mat_interface, bool updFlag) override;
     Element *giveElement() override { return this; }
@@ -178,6 +178,45 @@ public:
 };
 
 
+/**
+ * Implementation for assembling absolute row sums of matrices, i.e. @f$ v_i = \sum_j |A_{ij}| @f$.
+ * This is useful for Gershgorin estimates of the largest eigenvalue (e.g. for critical time step
+ * of explicit schemes), without constructing the global matrix.
+ */
+class OOFEM_EXPORT MatrixRowAbsSumAssembler : public VectorAssembler
+{
+protected:
+    const MatrixAssembler &mAssem;
+
+public:
+    MatrixRowAbsSumAssembler(const MatrixAssembler &m): VectorAssembler(), mAssem(m) {}
+
+    void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const override;
+    void vectorFromLoad(FloatArray &vec, Element &element, BodyLoad *load, TimeStep *tStep, ValueModeType mode) const override;
+    void vectorFromSurfaceLoad(FloatArray &vec, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep, ValueModeType mode) const override;
+    void vectorFromEdgeLoad(FloatArray &vec, Element &element, EdgeLoad *load, int edge, TimeStep *tStep, ValueModeType mode) const override;
+};
+
+
+/**
+ * Callback class for assembling the product of element matrices with a given global vector.
+ * Assembled over all elements, this gives the product of the global matrix with the vector
+ * without constructing the global matrix (see MatrixFreeSparseMtrx).
+ */
+class OOFEM_EXPORT MatrixVectorProductAssembler : public VectorAssembler
+{
+protected:
+    const MatrixAssembler &mAssem;
+    const FloatArray &x;
+    const UnknownNumberingScheme &s;
+
+public:
+    MatrixVectorProductAssembler(const MatrixAssembler &m, const FloatArray &x, const UnknownNumberingScheme &s): VectorAssembler(), mAssem(m), x(x), s(s) {}
+
+    void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const override;
+};
+
+
 /**
  * Implementation for assembling tangent matrices in standard monolithic FE-problems
  * @author Mikael Öhman
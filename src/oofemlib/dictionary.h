@@ -36,69 +36,46 @@
 #define dictionr_h
 
 #include "oofemenv.h"
-#include "pair.h"
 #include "error.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 
 #include <string>
 #include <iosfwd>
+#include <utility>
+#include <vector>
 
 namespace oofem {
 class DataStream;
 
 /**
- * This class implements a linked list whose entries are Pairs (see below).
+ * This class implements a small key/value map of doubles.
  *
  * Dictionaries are typically used by degrees of freedom for storing their unknowns.
- * A dictionary stores its pairs in a linked list form. It knows the first
- * pair (attribute 'first') of the list. It also knows the last one (attribute
- * 'last') in order to append an additional pair fast.
+ * The pairs are kept in a contiguous array in insertion order; dictionaries hold
+ * only a handful of entries, so a linear scan over contiguous memory is faster
+ * than any node based structure and adding an entry does not allocate per pair.
+ * Note that references returned by at() are invalidated when a new key is added.
  */
 class OOFEM_EXPORT Dictionary
 {
 protected:
-    /// First pair
-    Pair *first;
-    /// Last pair
-    Pair *last;
+    /// Stored key/value pairs.
+    std :: vector< std :: pair< int, double > >pairs;
 
 public:
     /// Constructor, creates empty dictionary
-    Dictionary() : first(NULL), last(NULL) { }
-    /// Destructor
-    ~Dictionary();
-
-    /// copy constructor
-    Dictionary(const Dictionary& other) {
-        Pair *next = other.first;
-        while ( next ) {
-            this->add(next->giveKey(), next->giveValue());
-            next = next->giveNext();
-        }    
-    }
-
-    /// copy assignment constructor
-    Dictionary& operator=(const Dictionary& other) { 
-        this->clear();
-        Pair *next = other.first;
-        while ( next ) {
-            this->add(next->giveKey(), next->giveValue());
-            next = next->giveNext();
-        }
-
-        return *this;
-    }
+    Dictionary() { }
 
     /// Clears the receiver.
-    void clear();
+    void clear() { pairs.clear(); }
     /**
      * Adds a new Pair with given keyword and value into receiver.
      * @param aKey key of new pair
      * @param value value of new pair
-     * @return New Pair with given keyword and value
+     * @return Reference to the value of the new pair
      */
-    Pair *add(int aKey, double value);
+    double &add(int aKey, double value);
     /**
      * Returns the value of the pair which key is aKey.
      * If requested key doesn't exist, it is created with assigned value 0.
@@ -118,7 +95,7 @@ public:
     /// Formats itself as string.
     void formatAsString(std :: string &str);
     /// Returns number of pairs of receiver.
-    int giveSize();
+    int giveSize() { return ( int ) pairs.size(); }
 
     /**
      * Saves the receiver contends (state) to given stream.
@@ -196,6 +196,23 @@ protected:
      */
     IntArray partitions;
 
+    /**
+     * Accumulated wall clock time [s] spent in evaluation of element contributions
+     * (internal forces, stiffness) since the last reset. Used to drive load balancing.
+     */
+    double measuredComputationalCost;
+
+    /**
+     * Location arrays cached for the numbering schemes supporting it (see UnknownNumberingScheme::giveLocationArrayCacheIndex),
+     * together with the equation numbering stamp of the engineering model they were built for.
+     * Filled only by updateLocationArrayCache, never from the const queries.
+     */
+    IntArray locationArrayCache [ 2 ];
+    int locationArrayCacheStamp [ 2 ];
+
+    /// Assembles the location array of receiver from its dof managers, bypassing the cache.
+    void computeLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIdArray) const;
+
 public:
     /**
      * Constructor. Creates an element with number n belonging to domain aDomain.
@@ -212,10 +229,19 @@ public:
     //@{
     /**
      * Returns the location array (array of code numbers) of receiver for given numbering scheme.
-     * Results are cached at receiver for default scheme in locationArray attribute.
+     * For default schemes the array cached by updateLocationArrayCache is returned as long as it
+     * matches the current equation numbering (see EngngModel::giveEquationNumberingStamp),
+     * otherwise it is assembled from the dof managers.
+     * The method only reads the receiver, so it may be called concurrently from several threads.
      */
     void giveLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
     void giveLocationArray(IntArray &locationArray, const IntArray &dofIDMask, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
+    /**
+     * Rebuilds the cached location arrays of the default numbering schemes for the current equation numbering.
+     * Invoked by the engineering model after the equations are renumbered; not safe to call
+     * concurrently with giveLocationArray on the same element.
+     */
+    void updateLocationArrayCache();
     /**
      * Returns the location array for the boundary of the element.
      * Only takes into account nodes in the bNodes vector.
@@ -1150,6 +1176,16 @@ public:
      * Returns the relative redistribution cost of the receiver
      */
     virtual double predictRelativeRedistributionCost() { return 1.0; }
+    /**
+     * Returns the wall clock time [s] measured during assembly of element contributions
+     * since the last call to resetMeasuredComputationalCost.
+     * The time is only recorded when element cost measurement is enabled in engineering model.
+     */
+    double giveMeasuredComputationalCost() const { return measuredComputationalCost; }
+    /// Adds the given wall clock time [s] to the measured computational cost of receiver.
+    void addMeasuredComputationalCost(double t) { measuredComputationalCost += t; }
+    /// Resets the measured computational cost of receiver.
+    void resetMeasuredComputationalCost() { measuredComputationalCost = 0.; }
 
 public:
     /// Returns array containing load numbers of loads acting on element
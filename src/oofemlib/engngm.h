@@ -68,6 +68,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 ///@name Input fields for general Engineering models.
 //@{
@@ -81,6 +82,7 @@
 #define _IFT_EngngModel_parallelflag "parallelflag"
 #define _IFT_EngngModel_loadBalancingFlag "lbflag"
 #define _IFT_EngngModel_forceloadBalancingFlag "forcelb1"
+#define _IFT_EngngModel_loadBalancingMeasuredCost "lbmeasuredcost"
 #define _IFT_EngngModel_initialGuess "initialguess"
 #define _IFT_EngngModel_referenceFile "referencefile"
 
@@ -227,6 +229,8 @@ protected:
     bool profileOpt;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
+    /// Counter incremented by every equation renumbering, used to invalidate cached element location arrays.
+    int equationNumberingStamp;
     /// Number of meta steps.
     int nMetaSteps;
     /// List of problem metasteps.
@@ -286,6 +290,8 @@ protected:
     int numProcs;
     /// Flag indicating if nonlocal extension active, which will cause data to be sent between shared elements before computing the internal forces.
     int nonlocalExt;
+    /// Flag indicating that wall clock time spent in element contributions is recorded (see Element::giveMeasuredComputationalCost).
+    bool elementCostMeasurementFlag;
 #ifdef __MPI_PARALLEL_MODE
     /// Processor name.
     char processor_name [ PROCESSOR_NAME_LENGTH ];
@@ -531,6 +537,8 @@ public:
 
     /// Only relevant for eigen value analysis. Otherwise returns zero.
     virtual double giveEigenValue(int eigNum) { return 0.0; }
+    /// Only relevant for analyses tracking the energy balance. Otherwise returns zero.
+    virtual double giveEnergyBalanceComponent(int component) { return 0.0; }
     /// Only relevant for eigen value  analysis. Otherwise does noting.
     virtual void setActiveVector(int i) { }
     /**
@@ -850,6 +858,11 @@ public:
      * to dofManagers.
      */
     virtual int forceEquationNumbering();
+    /**
+     * Returns the equation numbering stamp, which changes whenever the equations are renumbered.
+     * Allows to cache data derived from equation numbers (e.g. element location arrays).
+     */
+    int giveEquationNumberingStamp() const { return equationNumberingStamp; }
     /**
      * Indicates if EngngModel requires Dofs dictionaries to be updated.
      * If EngngModel does not support changes
@@ -973,6 +986,15 @@ public:
      */
     void assembleVectorFromElements(FloatArray &answer, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
                                     const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
+    /**
+     * Returns the partitioning of elements of given domain into assembly batches.
+     * Elements in the same batch must not share any dof manager (including masters of slave dofs),
+     * so that their contributions can be assembled into a vector concurrently without locking.
+     * Used by assembleVectorFromElements when no norms are requested.
+     * @param domain Domain to partition.
+     * @return Pointer to element batches (lists of element numbers), or nullptr if not supported (default).
+     */
+    virtual const std :: vector< IntArray > *giveElementAssemblyBatches(Domain *domain) { return nullptr; }
 
     /**
      * Assembles characteristic vector of required type from boundary conditions.
@@ -1108,6 +1130,8 @@ public:
     int giveRank() const { return rank; }
     /// Returns the number of collaborating processes.
     int giveNumberOfProcesses() const { return numProcs; }
+    /// Returns true if wall clock time spent in individual element contributions is measured.
+    bool isElementCostMeasurementOn() const { return elementCostMeasurementFlag; }
 
 
     /**
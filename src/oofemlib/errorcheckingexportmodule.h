@@ -183,6 +183,16 @@ public:
     const char *giveClassName() const override { return "EigenValueErrorCheckingRule"; }
 };
 
+/// Checks a component of the energy balance
+class OOFEM_EXPORT EnergyErrorCheckingRule : public ErrorCheckingRule
+{
+public:
+    EnergyErrorCheckingRule(const std :: string &line, double tol);
+    bool check(Domain *domain, TimeStep *tStep) override;
+    bool getValue(double& value, Domain* domain, TimeStep *tStep) override;
+    const char *giveClassName() const override { return "EnergyErrorCheckingRule"; }
+};
+
 /// Checks a reaction force value
 class OOFEM_EXPORT TimeCheckingRule : public ErrorCheckingRule
 {
@@ -35,11 +35,11 @@
 #ifndef geotoolbox_h
 #define geotoolbox_h
 
-#include <list>
+#include <vector>
 #include <cstdlib>
 
 #include "oofemenv.h"
-#include "floatarray.h"
+#include "floatarrayf.h"
 
 #ifdef __OOFEG
  #include "oofeggraphiccontext.h"
@@ -60,25 +60,14 @@ namespace oofem {
 class OOFEM_EXPORT Vertex
 {
 public:
-    FloatArray coords;
-    Vertex(double x = 0, double y = 0) : coords(2) {
-        coords(0) = x;
-        coords(1) = y;
-    }
-    Vertex(double c [ 2 ]) : coords(2) {
-        coords(0) = c [ 0 ];
-        coords(1) = c [ 1 ];
-    }
-    Vertex(const Vertex & src) : coords(src.coords) { }
-    Vertex &operator = ( const Vertex & src ) {
-        coords = src.coords;
-        return * this;
-    }
+    FloatArrayF< 2 >coords;
+    Vertex(double x = 0, double y = 0) : coords{x, y} { }
+    Vertex(double c [ 2 ]) : coords{c [ 0 ], c [ 1 ]} { }
     void setCoords(double x, double y) {
-        coords(0) = x;
-        coords(1) = y;
+        coords [ 0 ] = x;
+        coords [ 1 ] = y;
     }
-    const FloatArray *getCoords() const { return & coords; }
+    const FloatArrayF< 2 > *getCoords() const { return & coords; }
 };
 
 
@@ -86,14 +75,16 @@ public:
  * Class representing 2D polygon.
  * Polygon is represented as a sequence of vertices. THe services for adding vertices, computing volume,
  * testing if point is inside polygon are provided. Also iterators over polygon vertices and edges are provided.
+ * Vertices are stored contiguously with fixed size coordinates; clearing the polygon keeps the allocated
+ * storage, so that a polygon reused as scratch buffer does not allocate.
  * This class is a part of geometry toolbox.
  */
 class OOFEM_EXPORT Polygon
 {
-    std :: list< Vertex >vertices;
+    std :: vector< Vertex >vertices;
 public:
     Polygon() { }
-    void addVertex(Vertex v) { vertices.push_back(v); }
+    void addVertex(const Vertex &v) { vertices.push_back(v); }
     double computeVolume() const;
     int testPoint(double x, double y) const;
     double pointDistance(double x, double y) const;
@@ -107,7 +98,7 @@ public:
         bool last;
         const Polygon *ptr;
         Vertex curr;
-        std :: list< Vertex > :: const_iterator iter;
+        std :: vector< Vertex > :: const_iterator iter;
 public:
         PolygonEdgeIterator(const Polygon * p) : ptr(NULL), iter()  {
             iter = p->vertices.begin();
@@ -144,7 +135,7 @@ public:
     class PolygonVertexIterator
     {
         const Polygon *ptr;
-        std :: list< Vertex > :: const_iterator iter;
+        std :: vector< Vertex > :: const_iterator iter;
 public:
         PolygonVertexIterator(const Polygon * p) : iter() {
             iter = p->vertices.begin();
@@ -211,6 +202,7 @@ public:
     Graph() : s(NULL), c(NULL) { }
     ~Graph();
 
+    /// Computes the intersection of polygons a and b; the receiver can be reused for several clippings.
     void clip(Polygon &result, const Polygon &a, const Polygon &b);
 protected:
     void insert(node *ins, node *first, node *last);     // insert node in graph
@@ -37,7 +37,9 @@
 
 #include "feinterpol.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
 #include <array>
+#include <vector>
 
 ///@name Input fields for BSplineInterpolation
 //@{
@@ -79,6 +81,12 @@ protected:
     std::array<FloatArray, 3> knotVector;                           // eg. 0 0 0 1 2 3 4 4 5 5 5
     /// Nonzero spans in each directions [nsd]
     std::array<int, 3> numberOfKnotSpans;                        // eg. 5 (0-1,1-2,2-3,3-4,4-5)
+    /**
+     * Bezier extraction operators [nsd][knot span index], set for nonzero spans only.
+     * The nonzero basis functions on a span are obtained as the extraction operator
+     * times the Bernstein polynomials of the span.
+     */
+    std::array<std::vector<FloatMatrix>, 3> bezierExtraction;
 public:
     BSplineInterpolation(int nsd) : FEInterpolation(0),
         nsd(nsd)
@@ -197,6 +205,42 @@ public:
     { OOFEM_ERROR("Not supported."); }
 
 protected:
+    /**
+     * Evaluates the nonvanishing basis functions in given direction using the precomputed Bezier extraction operators.
+     * @param N Computed p+1 nonvanishing functions.
+     * @param dir Parametric direction (zero based).
+     * @param span Knot span index (zero based).
+     * @param u Value at which to evaluate.
+     */
+    void giveBasisFuns(FloatArray &N, int dir, int span, double u) const;
+    /**
+     * Evaluates the nonvanishing basis functions and their derivatives in given direction
+     * using the precomputed Bezier extraction operators.
+     * The layout of ders is the same as in dersBasisFuns.
+     * @param n Degree of the derivation.
+     * @param dir Parametric direction (zero based).
+     * @param span Knot span index (zero based).
+     * @param u Parametric value.
+     * @param ders Matrix containing the derivatives of the basis functions.
+     */
+    void giveDersBasisFuns(int n, int dir, int span, double u, FloatMatrix &ders) const;
+    /**
+     * Computes the Bezier extraction operators of a 1d knot vector
+     * (algorithm 1 from Borden et al., Isogeometric finite element data structures based on Bezier extraction of NURBS, 2011).
+     * @param C Extraction operators, indexed by the knot span index.
+     * @param p Degree.
+     * @param U Knot vector.
+     */
+    void computeBezierExtraction(std::vector<FloatMatrix> &C, int p, const FloatArray &U) const;
+    /**
+     * Evaluates the Bernstein polynomials of degree p and their derivatives on a span.
+     * @param B Matrix of size (n+1, p+1) with derivatives with respect to the knot parameter.
+     * @param n Degree of the derivation.
+     * @param p Degree.
+     * @param xi Local coordinate within the span, in range <0;1>.
+     * @param h Length of the span.
+     */
+    static void evalBernstein(FloatMatrix &B, int n, int p, double xi, double h);
     /**
      * Evaluates the nonvanishing basis functions of 1d BSpline (algorithm A2.2 from NURBS book)
      * @param span Knot span index (zero based).
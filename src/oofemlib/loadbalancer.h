@@ -55,6 +55,7 @@ class EngngModel;
 class ProcessCommunicator;
 class TimeStep;
 class IntArray;
+class Element;
 
  #define MIGRATE_LOAD_TAG       9998
 
@@ -120,13 +121,15 @@ public:
     };
 protected:
     Domain *domain;
+    /// Scaling factor converting measured element cost [s] into relative computational cost units (zero if not available).
+    double measuredCostScale;
 
 public:
 
     LoadBalancer(Domain * d);
     virtual ~LoadBalancer() { }
 #ifdef _MSC_VER
-    LoadBalancer(LoadBalancer&& src) {domain = src.domain;}
+    LoadBalancer(LoadBalancer&& src) {domain = src.domain; measuredCostScale = src.measuredCostScale;}
 #endif
 
 
@@ -144,6 +147,26 @@ public:
     /// Print receiver statistics
     virtual void  printStatistics() const;
 
+    /**@name Element cost evaluation methods */
+    //@{
+    /**
+     * Updates the scaling of measured element costs, so that their global sum matches
+     * the global sum of predicted costs of measured elements. This keeps measured costs
+     * in the same units as Element::predictRelativeComputationalCost.
+     * Collective operation, has to be invoked on all partitions. Has no effect
+     * when element cost measurement is not active in engineering model.
+     */
+    void updateMeasuredCostScale();
+    /**
+     * Returns the relative computational cost of given element, used as its partitioning weight.
+     * If element cost measurement is active and the element has been measured,
+     * its scaled measured cost is returned. Otherwise the predicted cost is used.
+     */
+    double giveElementComputationalCost(Element *elem);
+    /// Resets measured cost of all elements of receiver's domain, starting a new measurement window.
+    void resetMeasuredCost();
+    //@}
+
     /**@name Query methods after work transfer calculation */
     //@{
     /// Returns the label of dofmanager after load balancing.
@@ -0,0 +1,104 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef matrixfreesparsemtrx_h
+#define matrixfreesparsemtrx_h
+
+#include "sparsemtrx.h"
+#include "floatarray.h"
+#include "unknownnumberingscheme.h"
+
+namespace oofem {
+class MatrixAssembler;
+class TimeStep;
+class IntArray;
+class FloatMatrix;
+
+/**
+ * Sparse matrix which does not store its coefficients. The product with a vector is evaluated
+ * element by element, using the element contributions given by the attached matrix assembler
+ * (see setOperator), so that no global matrix has to be kept in memory.
+ * Only the diagonal is stored; it is obtained by regular assembly into the receiver and can
+ * be used by diagonal preconditioners. The receiver is therefore intended for iterative solvers.
+ * Load matrices of set-based loads are included in the product; active boundary conditions
+ * are not supported, as their contributions can only be assembled.
+ * Note that every product re-evaluates all element matrices, so that each Krylov iteration
+ * costs one full tangent evaluation.
+ */
+class OOFEM_EXPORT MatrixFreeSparseMtrx : public SparseMtrx
+{
+protected:
+    /// Engineering model assembling the element contributions.
+    EngngModel *eModel;
+    /// Domain index.
+    int di;
+    /// Assembler providing the element matrices.
+    const MatrixAssembler *ma;
+    /// Solution step for which the element matrices are evaluated.
+    TimeStep *tStep;
+    /// Equation numbering.
+    EModelDefaultEquationNumbering numbering;
+    /// Assembled diagonal.
+    FloatArray diagonal;
+
+    /// Adds the product of given local matrix with the values of x at loc to answer.
+    void addLocalProduct(FloatArray &answer, const IntArray &loc, const FloatMatrix &mat, const FloatArray &x) const;
+
+public:
+    /// Constructor.
+    MatrixFreeSparseMtrx(int n=0);
+    /// Destructor
+    virtual ~MatrixFreeSparseMtrx() { }
+
+    /**
+     * Sets the assembler providing the element matrices and the step for which they are evaluated.
+     * The assembler has to outlive all subsequent products.
+     */
+    void setOperator(const MatrixAssembler *ma, TimeStep *tStep);
+
+    void times(const FloatArray &x, FloatArray &answer) const override;
+    int buildInternalStructure(EngngModel *eModel, int di, const UnknownNumberingScheme &s) override;
+    int assemble(const IntArray &loc, const FloatMatrix &mat) override;
+    int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool canBeFactorized() const override { return false; }
+    void zero() override;
+    double &at(int i, int j) override;
+    double at(int i, int j) const override;
+    const char *giveClassName() const override { return "MatrixFreeSparseMtrx"; }
+    SparseMtrxType giveType() const override { return SMT_MatrixFree; }
+    bool isAsymmetric() const override { return true; }
+};
+} // end namespace oofem
+#endif // matrixfreesparsemtrx_h
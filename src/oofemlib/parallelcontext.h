@@ -106,6 +106,10 @@ public:
      * Accumulates the global value.
      */
     void accumulate(const FloatArray &local, FloatArray &global);
+    /**
+     * Returns the global maximum of local values.
+     */
+    double maximum(double local);
     //@}
 
 #ifdef __MPI_PARALLEL_MODE
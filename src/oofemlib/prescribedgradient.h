@@ -112,6 +112,16 @@ public:
 
     const char *giveClassName() const override { return "PrescribedGradient"; }
     const char *giveInputRecordName() const override { return _IFT_PrescribedGradient_Name; }
+
+protected:
+    /**
+     * Computes the same tangent as computeTangent without assembling the rectangular free-prescribed blocks,
+     * which only the PETSc matrix supports. Their products with the coefficient matrix are evaluated element by element,
+     * so only the free-free block is assembled and solved with the direct solver.
+     * @param tangent Output tangent.
+     * @param tStep Active time step.
+     */
+    void computeTangentByElements(FloatMatrix &tangent, TimeStep *tStep);
 };
 } // end namespace oofem
 
@@ -32,48 +32,49 @@
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#ifndef pair_h
-#define pair_h
-
-#include <cstdio>
+#ifndef stepsharedvalue_h
+#define stepsharedvalue_h
 
 namespace oofem {
 /**
- * This class implements key/value associations - the key and its associated value.
- * An instance of Pair is used as an entry in a dictionary.
- * Pair has three components - its key, its value and pointer to the next Pair in the dictionary.
- *
- * Tasks:
- * - Returning its key, or its value, or the next pair ;
- * - Appending another pair to itself.
- *
+ * Value evaluated once per time step and shared by all its users, e.g. a tangent shared by all
+ * integration points of a material with linear response.
+ * The first request in a step evaluates the value, the following ones in the same step are
+ * given the stored value. Requests are serialized, so they may come from parallel assembly.
  */
-class OOFEM_EXPORT Pair
+template< class T >
+class StepSharedValue
 {
-private:
-    /// Key.
-    int key;
-    /// Associate value.
-    double value;
-    /// Pointer to the next Pair.
-    Pair *next;
+protected:
+    /// Stored value.
+    T value;
+    /// Number of time step in which the value was evaluated.
+    int stepNumber = -1;
 
 public:
-    /// Constructor - creates the new Pair with given key k and value v.
-    Pair(int k, double v) : key(k), value(v), next(NULL) { }
-    /// Destructor
-    ~Pair() { }
+    StepSharedValue() : value() { }
 
-    /// Appends a given pair to itself (sets the pointer to next pair to given Pair).
-    void append(Pair *p) { next = p; }
-    /// Returns the receiver key.
-    int giveKey() { return key; }
-    /// Returns pointer to the next pair.
-    Pair *giveNext() { return next; }
-    /// Returns associated value.
-    double &giveValue() { return value; }
-    /// Prints receiver to screen.
-    void printYourself() { printf("   Pair (%d,%f)\n", key, value); }
+    /**
+     * Gives the value for given time step.
+     * @param step Time step number.
+     * @param evaluate Called as evaluate() when the value has not been evaluated in given step yet, returns the value.
+     * @param use Called as use(value) with the stored value otherwise.
+     */
+    template< class Evaluate, class Use >
+    void giveValue(int step, Evaluate evaluate, Use use)
+    {
+#ifdef _OPENMP
+ #pragma omp critical (StepSharedValue)
+#endif
+        {
+            if ( this->stepNumber != step ) {
+                this->value = evaluate();
+                this->stepNumber = step;
+            } else {
+                use(this->value);
+            }
+        }
+    }
 };
 } // end namespace oofem
-#endif // pair_h
+#endif // stepsharedvalue_h
@@ -70,6 +70,13 @@ public:
      * Returns required number of domain equation. Number is always less or equal to the sum of all DOFs gathered from all nodes.
      */
     virtual int giveRequiredNumberOfDomainEquation() const { return 0; }
+
+    /**
+     * Returns the index of the element location array cache (see Element::giveLocationArray) used for the receiver.
+     * Only schemes whose equation numbers depend solely on the dof equation numbering of the engineering model
+     * may be cached. Zero means the location arrays are never cached.
+     */
+    virtual int giveLocationArrayCacheIndex() const { return 0; }
 };
 
 /**
@@ -86,6 +93,7 @@ public:
     int giveDofEquationNumber(Dof *dof) const override {
         return dof->__giveEquationNumber();
     }
+    int giveLocationArrayCacheIndex() const override { return 1; }
 };
 
 /**
@@ -102,6 +110,7 @@ public:
     int giveDofEquationNumber(Dof *dof) const override {
         return dof->__givePrescribedEquationNumber();
     }
+    int giveLocationArrayCacheIndex() const override { return 2; }
 };
 
 
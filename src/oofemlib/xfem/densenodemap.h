@@ -0,0 +1,137 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef densenodemap_h
+#define densenodemap_h
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+
+namespace oofem {
+/**
+ * Node number keyed map with dense storage, used by the enrichment items for
+ * level sets and node enrichment markers. The keys are local node numbers.
+ * Lookup goes through a slot array indexed directly by node number, while the
+ * values themselves are kept contiguously in insertion order. This keeps the
+ * interface of std::unordered_map that the enrichment fronts rely on
+ * (find, end, operator[], iteration over (node, value) pairs), but avoids
+ * hashing in the per-node queries done during assembly.
+ * The slot array only spans the range of node numbers actually inserted, so
+ * its size follows the narrow band of nodes around the interface rather than
+ * the size of the mesh.
+ *
+ * Iterators are invalidated by insertion of new nodes.
+ */
+template< class T >
+class DenseNodeMap
+{
+public:
+    typedef std :: pair< int, T >value_type;
+    typedef typename std :: vector< value_type > :: iterator iterator;
+    typedef typename std :: vector< value_type > :: const_iterator const_iterator;
+
+protected:
+    /// Entries in insertion order.
+    std :: vector< value_type >entries;
+    /// Position + 1 of each node in entries, zero if the node is not present. Indexed from firstNode.
+    std :: vector< int >slots;
+    /// Node number of the first slot.
+    int firstNode = 0;
+
+    int giveSlot(int node) const
+    {
+        int i = node - firstNode;
+        return ( i >= 0 && i < ( int ) slots.size() ) ? slots [ i ] : 0;
+    }
+
+public:
+    DenseNodeMap() { }
+
+    iterator begin() { return entries.begin(); }
+    iterator end() { return entries.end(); }
+    const_iterator begin() const { return entries.begin(); }
+    const_iterator end() const { return entries.end(); }
+
+    std :: size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    iterator find(int node)
+    {
+        int s = this->giveSlot(node);
+        return s ? entries.begin() + ( s - 1 ) : entries.end();
+    }
+
+    const_iterator find(int node) const
+    {
+        int s = this->giveSlot(node);
+        return s ? entries.begin() + ( s - 1 ) : entries.end();
+    }
+
+    bool contains(int node) const { return this->giveSlot(node) != 0; }
+
+    /// Returns the value of given node, inserting a value initialized entry if not present.
+    T &operator[](int node)
+    {
+        int s = this->giveSlot(node);
+        if ( s ) {
+            return entries [ s - 1 ].second;
+        }
+        if ( slots.empty() ) {
+            firstNode = node;
+            slots.assign(1, 0);
+        } else if ( node < firstNode ) {
+            // grow geometrically towards lower numbers as well, to keep insertion amortized constant
+            int n = std :: max( firstNode - node, ( int ) slots.size() );
+            slots.insert(slots.begin(), n, 0);
+            firstNode -= n;
+        } else if ( node - firstNode >= ( int ) slots.size() ) {
+            slots.resize(node - firstNode + 1, 0);
+        }
+        entries.emplace_back( node, T() );
+        slots [ node - firstNode ] = ( int ) entries.size();
+        return entries.back().second;
+    }
+
+    /// Removes all entries. The allocated storage is kept for reuse.
+    void clear()
+    {
+        entries.clear();
+        slots.clear();
+    }
+};
+} // end namespace oofem
+#endif // densenodemap_h
@@ -40,7 +40,7 @@
 #include "inputrecord.h"
 #include "xfem/tipinfo.h"
 
-#include <unordered_map>
+#include "xfem/densenodemap.h"
 
 namespace oofem {
 class XfemManager;
@@ -105,7 +105,7 @@ public:
      *                      should get special treatment. May also modify the set of nodes
      *                      enriched by the interior enrichment.
      */
-    virtual void MarkNodesAsFront(std :: unordered_map< int, NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const std :: unordered_map< int, double > &iLevelSetNormalDirMap, const std :: unordered_map< int, double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) = 0;
+    virtual void MarkNodesAsFront(DenseNodeMap< NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const DenseNodeMap< double > &iLevelSetNormalDirMap, const DenseNodeMap< double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) = 0;
 
     // The number of enrichment functions applied to tip nodes.
     virtual int  giveNumEnrichments(const DofManager &iDMan) const = 0;
@@ -142,7 +142,7 @@ protected:
      * Several enrichment fronts enrich all nodes in the tip element.
      * This help function accomplishes that.
      */
-    void MarkTipElementNodesAsFront(std :: unordered_map< int, NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan,  const std :: unordered_map< int, double > &iLevelSetNormalDirMap, const std :: unordered_map< int, double > &iLevelSetTangDirMap, const TipInfo &iTipInfo);
+    void MarkTipElementNodesAsFront(DenseNodeMap< NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan,  const DenseNodeMap< double > &iLevelSetNormalDirMap, const DenseNodeMap< double > &iLevelSetTangDirMap, const TipInfo &iTipInfo);
 };
 } // end namespace oofem
 
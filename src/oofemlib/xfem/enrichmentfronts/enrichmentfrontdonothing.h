@@ -61,7 +61,7 @@ public:
     EnrFrontDoNothing(int iEIindex = 0) : EnrichmentFront(iEIindex) { }
     virtual ~EnrFrontDoNothing() { }
 
-    void MarkNodesAsFront(std :: unordered_map< int, NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const std :: unordered_map< int, double > &iLevelSetNormalDirMap, const std :: unordered_map< int, double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override { mTipInfo = iTipInfo; }
+    void MarkNodesAsFront(DenseNodeMap< NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const DenseNodeMap< double > &iLevelSetNormalDirMap, const DenseNodeMap< double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override { mTipInfo = iTipInfo; }
 
     // No special tip enrichments are applied with this model.
     int giveNumEnrichments(const DofManager &iDMan) const override { return 0; }
@@ -61,7 +61,7 @@ public:
     EnrFrontExtend() { }
     virtual ~EnrFrontExtend() { }
 
-    void MarkNodesAsFront(std :: unordered_map< int, NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan,  const std :: unordered_map< int, double > &iLevelSetNormalDirMap, const std :: unordered_map< int, double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override;
+    void MarkNodesAsFront(DenseNodeMap< NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan,  const DenseNodeMap< double > &iLevelSetNormalDirMap, const DenseNodeMap< double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override;
 
     // No special tip enrichments are applied with this model,
     // it only modifies the set of nodes subject to bulk enrichment.
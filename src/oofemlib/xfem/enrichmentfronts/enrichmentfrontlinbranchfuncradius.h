@@ -64,7 +64,7 @@ public:
     EnrFrontLinearBranchFuncRadius();
     virtual ~EnrFrontLinearBranchFuncRadius();
 
-    void MarkNodesAsFront(std :: unordered_map< int, NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const std :: unordered_map< int, double > &iLevelSetNormalDirMap, const std :: unordered_map< int, double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override;
+    void MarkNodesAsFront(DenseNodeMap< NodeEnrichmentType > &ioNodeEnrMarkerMap, XfemManager &ixFemMan, const DenseNodeMap< double > &iLevelSetNormalDirMap, const DenseNodeMap< double > &iLevelSetTangDirMap, const TipInfo &iTipInfo) override;
 
     int giveNumEnrichments(const DofManager &iDMan) const override;
     int giveMaxNumEnrichments() const override { return 4; }
@@ -42,10 +42,10 @@
 #include "dofmanager.h"
 #include "xfem/enrichmentfronts/enrichmentfront.h"
 #include "xfem/enrichmentfunction.h"
+#include "xfem/densenodemap.h"
 #include "error.h"
 
 #include <vector>
-#include <unordered_map>
 
 ///@name Input fields for XFEM
 //@{
@@ -224,7 +224,7 @@ public:
     virtual void callGnuplotExportModule(GnuplotExportModule &iExpMod, TimeStep *tStep);
 
 
-    const std :: unordered_map< int, NodeEnrichmentType > &giveEnrNodeMap() const { return mNodeEnrMarkerMap; }
+    const DenseNodeMap< NodeEnrichmentType > &giveEnrNodeMap() const { return mNodeEnrMarkerMap; }
 
     virtual void giveBoundingSphere(FloatArray &oCenter, double &oRadius) = 0;
 
@@ -276,18 +276,21 @@ protected:
     IntArray mpEnrichesDofsWithIdArray;
 
 
+    // The level sets and node markers are only stored in a narrow band around
+    // the interface, in dense arrays indexed by the node number.
+
     // Level set for signed distance to the interface.
     // The sign is determined by the interface normal direction.
     // This level set function is relevant for both open and closed interfaces.
-    std :: unordered_map< int, double >mLevelSetNormalDirMap;
+    DenseNodeMap< double >mLevelSetNormalDirMap;
 
     // Level set for signed distance along the interface.
     // Only relevant for open interfaces.
-    std :: unordered_map< int, double >mLevelSetTangDirMap;
+    DenseNodeMap< double >mLevelSetTangDirMap;
 
 
     // Field with desired node enrichment types
-    std :: unordered_map< int, NodeEnrichmentType >mNodeEnrMarkerMap;
+    DenseNodeMap< NodeEnrichmentType >mNodeEnrMarkerMap;
 
     // Enrichment dof IDs used by the enrichment item.
     IntArray mEIDofIdArray;
@@ -301,8 +304,7 @@ protected:
 
 inline bool EnrichmentItem :: isDofManEnriched(const DofManager &iDMan) const
 {
-    auto res = mNodeEnrMarkerMap.find( iDMan.giveGlobalNumber() );
-    return !( res == mNodeEnrMarkerMap.end() );
+    return mNodeEnrMarkerMap.contains( iDMan.giveNumber() );
 }
 } // end namespace oofem
 
@@ -36,8 +36,11 @@
 #define SRC_OOFEMLIB_XFEM_NUCLEATIONCRITERION_H_
 
 
+#include "floatarray.h"
+
 #include <memory>
 #include <vector>
+#include <functional>
 
 namespace oofem {
 
@@ -47,6 +50,8 @@ class DataReader;
 class DynamicDataReader;
 class InputRecord;
 class EnrichmentFunction;
+class Element;
+class GaussPoint;
 
 class NucleationCriterion
 {
@@ -68,6 +73,28 @@ public:
     virtual const char *giveInputRecordName() const = 0;
 
 protected:
+    /// Bulk Gauss point where the nucleation criterion is fulfilled.
+    struct NucleationCandidate
+    {
+        Element *mElement;
+        int mIntegrationRuleIndex;
+        GaussPoint *mGP;
+        /// Value of the criterion, e.g. the largest principal stress.
+        double mValue;
+        FloatArray mCrackNormal;
+    };
+
+    /**
+     * Evaluates a nucleation criterion in all bulk Gauss points of the domain.
+     * The evaluation is independent for each element and is done in parallel.
+     * @param oCandidates Gauss points fulfilling the criterion, ordered by element, integration rule and Gauss point.
+     * @param iCriterion Returns true if the criterion is fulfilled in the Gauss point, together with its value and crack normal.
+     * @param iCrossSectionInd Only elements with this cross section are considered, all elements if zero.
+     */
+    void giveNucleationCandidates(std::vector<NucleationCandidate> &oCandidates,
+                                  const std::function<bool(GaussPoint &, double &, FloatArray &)> &iCriterion,
+                                  int iCrossSectionInd = 0);
+
     Domain *mpDomain;
     std::unique_ptr<EnrichmentFunction> mpEnrichmentFunc;
 };
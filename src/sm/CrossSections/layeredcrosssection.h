@@ -44,6 +44,7 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 ///@name Input fields for LayeredCrossSection
 //@{
@@ -59,6 +60,7 @@
 #define _IFT_LayeredCrossSection_nlayerintegrationpoints "layerintegrationpoints"
 #define _IFT_LayeredCrossSection_initiationlimits "initiationlimits"
 #define _IFT_LayeredCrossSection_shearcoeff_xz "beamshearcoeffxz"
+#define _IFT_LayeredCrossSection_parallelLayers "parallellayers"
 //@}
 
 namespace oofem {
@@ -107,6 +109,13 @@ protected:
     double totalThick = 0.;
     double area = 0.;
     double beamShearCoeffxz = 1.0;
+    /// Flag for evaluation of layers in parallel (shell and plate stresses).
+    bool parallelLayers = false;
+    /// Cached integrated plate and shell stiffness, used when all layers are isotropic linear elastic.
+    mutable FloatMatrixF< 5, 5 >plateStiffness;
+    mutable FloatMatrixF< 8, 8 >shellStiffness;
+    mutable std :: atomic< bool >plateStiffnessCached{ false }, shellStiffnessCached{ false };
+
 public:
     LayeredCrossSection(int n, Domain *d) :
         StructuralCrossSection(n, d)
@@ -270,6 +279,12 @@ public:
 protected:
     double giveArea() const;
     int giveSlaveGPIndex(int ilayer, int igp) const;
+    /// Returns true if the stiffness of all layers is constant (isotropic linear elastic layers, all cast at given time).
+    bool hasConstantLayerStiffness(TimeStep *tStep) const;
+    /// Integrates the plate stiffness over layers.
+    FloatMatrixF< 5, 5 >compute2dPlateStiffMtrx(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const;
+    /// Integrates the shell stiffness over layers.
+    FloatMatrixF< 8, 8 >compute3dShellStiffMtrx(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) const;
 };
 
 /**
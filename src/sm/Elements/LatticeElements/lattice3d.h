@@ -36,6 +36,7 @@
 #define lattice3d_h
 
 #include "latticestructuralelement.h"
+#include "floatmatrixf.h"
 
 ///@name Input fields for Lattice3d
 //@{
@@ -67,6 +68,9 @@ protected:
     int couplingFlag;
     IntArray couplingNumbers;
     FloatArray pressures;
+    /// Cached strain-displacement matrix; depends on geometry only.
+    FloatMatrixF< 6, 12 >bMatrix;
+    int bMatrixFlag;
 
 public:
     Lattice3d(int n, Domain *);
@@ -87,6 +91,8 @@ public:
 
     void giveDofManDofIDMask(int inode, IntArray &) const override;
 
+    void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0) override;
+
     double computeVolumeAround(GaussPoint *) override;
 
     int giveNumberOfCrossSectionNodes() override { return numberOfPolygonVertices; }
@@ -145,6 +151,13 @@ protected:
     void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep) override;
     void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) override;
 
+    /**
+     * Returns the strain-displacement matrix of the receiver. It is evaluated
+     * once from the element geometry and kept in fixed-size storage, so that
+     * stiffness and internal forces avoid dynamic temporaries.
+     */
+    const FloatMatrixF< 6, 12 > &giveBmatrix();
+
     /**
      * This computes the geometrical properties of the element once.
      */
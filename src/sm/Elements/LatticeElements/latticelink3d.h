@@ -36,6 +36,7 @@
 #define latticelink3d_h
 
 #include "latticestructuralelement.h"
+#include "floatmatrixf.h"
 
 ///@name Input fields for LatticeLink3d
 //@{
@@ -63,6 +64,9 @@ protected:
     double bondEndLength;
     FloatArray rigid;
     FloatArray globalCentroid;
+    /// Cached strain-displacement matrix; depends on geometry only.
+    FloatMatrixF< 6, 12 >bMatrix;
+    int bMatrixFlag;
 
 public:
     LatticeLink3d(int n, Domain *);
@@ -116,6 +120,11 @@ protected:
     void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep) override;
     void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) override;
 
+    /**
+     * Returns the strain-displacement matrix of the receiver. It is evaluated
+     * once from the rigid arm geometry and kept in fixed-size storage.
+     */
+    const FloatMatrixF< 6, 12 > &giveBmatrix();
 
     /**
      * This computes the geometrical properties of the element. It is called only once.
@@ -42,6 +42,7 @@
 #include "sparsemtrxtype.h"
 
 #include <memory>
+#include <vector>
 
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
@@ -55,6 +56,8 @@
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
 #define _IFT_NlDEIDynamic_reduct "reduct"
+#define _IFT_NlDEIDynamic_elementbatching "elementbatching"
+#define _IFT_NlDEIDynamic_energycheck "energycheck"
 //@}
 
 namespace oofem {
@@ -87,6 +90,11 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * Optionally, elements can be grouped into assembly batches of elements sharing no dof managers
+ * (elements of the same type are kept together within a batch). Internal forces are then
+ * evaluated batch by batch, in parallel within a batch, and scattered without locking.
+ * The energy balance (kinetic energy, internal, external and damping work) can be checked periodically.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -122,6 +130,22 @@ protected:
     double Tau;
     /// Estimate of loadRefVector^T*displacementVector(Tau).
     double pyEstimate;
+
+    /// Flag indicating whether internal forces are assembled in element batches.
+    bool elementBatchingFlag = false;
+    /// Element assembly batches; elements in one batch share no dof managers.
+    std :: vector< IntArray > elementBatches;
+    /// Equation numbering stamp for which elementBatches have been built.
+    int elementBatchesStamp = -1;
+
+    /// Number of steps between energy balance checks (0 means no check).
+    int energyCheckInterval = 0;
+    /// Internal, external and damping work accumulated since the energy check started.
+    double internalWork = 0., externalWork = 0., dampingWork = 0.;
+    /// Number of steps over which the work has been accumulated.
+    int energyCheckSteps = 0;
+    /// Kinetic energy at the start of the energy check and at the last half step.
+    double initialKineticEnergy = 0., kineticEnergy = 0.;
     /// Product of p^tM^(-1)p; where p is reference load vector.
     double pMp;
 
@@ -151,6 +175,8 @@ public:
 
     void printDofOutputAt(FILE *stream, Dof *iDof, TimeStep *tStep) override;
 
+    const std :: vector< IntArray > *giveElementAssemblyBatches(Domain *domain) override;
+
     // identification
     const char *giveInputRecordName() const { return _IFT_NlDEIDynamic_Name; }
     const char *giveClassName() const override { return "NlDEIDynamic"; }
@@ -178,9 +204,28 @@ protected:
      */
     void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Accumulates the work of internal, external and damping forces of the current step and updates the kinetic energy.
+     * The forces at step n do work on the mean increment (du_n + du_{n-1})/2 and the kinetic energy
+     * is evaluated at the half step, 1/2 M (du_n/dt)^2, so that the balance is an exact identity of the
+     * central difference scheme and closes up to round-off. Sums run over the unknown dofs.
+     * @param externalForces External forces at current step.
+     * @param previousIncrement Displacement increment du_{n-1}.
+     */
+    void updateEnergyBalance(const FloatArray &externalForces, const FloatArray &previousIncrement);
+    /**
+     * Reports the energy balance every energyCheckInterval steps.
+     * @param tStep Time step.
+     */
+    void checkEnergyBalance(TimeStep *tStep);
 
 public:
     int estimateMaxPackSize(IntArray &commMap, DataStream &buff, int packUnpackType) override;
+    /**
+     * Returns the energy balance components: 1 kinetic energy, 2 internal work, 3 external work,
+     * 4 damping work, 5 balance error (kinetic energy change plus internal and damping work minus external work).
+     */
+    double giveEnergyBalanceComponent(int component) override;
 };
 } // end namespace oofem
 #endif // nldeidynamic_h
@@ -65,6 +65,14 @@ public:
  */
 class KelvinChainMaterial : public RheoChainMaterial
 {
+protected:
+    /**
+     * Values 1-exp(-t_r/tau_mu) of the unit compliance functions at the discrete times (nUnits x rSize)
+     * and the matrix of the least-square problem assembled from them. Both depend only on the
+     * characteristic and discrete times, so they are computed once and reused for every tPrime.
+     */
+    mutable FloatMatrix lsqBasis, lsqMatrix;
+
 public:
     KelvinChainMaterial(int n, Domain *d);
 
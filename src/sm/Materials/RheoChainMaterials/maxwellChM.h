@@ -66,6 +66,14 @@ public:
  */
 class MaxwellChainMaterial : public RheoChainMaterial
 {
+protected:
+    /**
+     * Values exp(-t_r/tau_mu) of the unit relaxation functions at the discrete times (nUnits x rSize)
+     * and the matrix of the least-square problem assembled from them. With unit chartime exponents
+     * they do not depend on tPrime, so they are computed once and reused.
+     */
+    mutable FloatMatrix lsqBasis, lsqMatrix;
+
 public:
     MaxwellChainMaterial(int n, Domain *d);
 
@@ -38,6 +38,9 @@
 #include "sm/Materials/structuralmaterial.h"
 #include "matconst.h"
 #include "floatarrayf.h"
+#include "floatmatrix.h"
+
+#include <vector>
 
 ///@name Input fields for MicroplaneMaterial
 //@{
@@ -99,6 +102,19 @@ protected:
      */
     std::vector<FloatArrayF<6>> L;
 
+    /**
+     * Projection tensors of all microplanes stacked into one matrix (3*numberOfMicroplanes x 6),
+     * rows 3*i+1, 3*i+2, 3*i+3 hold N, M and L of the i-th microplane (0-based).
+     * The strain components on all microplanes are thus obtained by a single matrix-vector product.
+     */
+    FloatMatrix projectionNML;
+    /**
+     * Weighted homogenization tensors of all microplanes stacked in the same way as projectionNML,
+     * holding w*(N-delta/3), w*M and w*L, so that integration of the deviatoric normal and shear
+     * microplane stresses is a single transposed matrix-vector product.
+     */
+    FloatMatrix homogenizationNML;
+
     /// Young's modulus
     double E = 0.;
 
@@ -139,6 +155,18 @@ public:
      * vector on given microplane.
      */
     MicroplaneState computeStrainVectorComponents(int mnumber, const FloatArray &macroStrain) const;
+    /**
+     * Computes the strain components on all microplanes at once.
+     * @param answer Strain components, one entry per microplane.
+     * @param macroStrain Macroscopic strain.
+     */
+    void computeStrainVectorComponents(std::vector<MicroplaneState> &answer, const FloatArrayF<6> &macroStrain) const;
+    /**
+     * Integrates the deviatoric normal and shear microplane stresses over the unit hemisphere, i.e. computes
+     * @f$ \sum_{\mu} w_{\mu} \left[ (N_{\mu}-\delta/3) \sigma^D_{\mu} + M_{\mu} \sigma^M_{\mu} + L_{\mu} \sigma^L_{\mu} \right] @f$.
+     * @param mPlaneStress Deviatoric normal, M-shear and L-shear stress of each microplane, stored consecutively.
+     */
+    FloatArrayF<6> integrateMicroplaneStresses(const FloatArray &mPlaneStress) const;
 
 
     /**
@@ -37,14 +37,19 @@
 
 #include "sm/Materials/structuralmaterial.h"
 #include "sm/Materials/structuralms.h"
+#include "stepsharedvalue.h"
 
 #include <memory>
+#include <atomic>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_sharedTangent "sharedtangent"
+#define _IFT_StructuralFE2Material_cacheTol "cachetol"
+#define _IFT_StructuralFE2Material_reuseTangentTol "reusetangenttol"
 //@}
 
 namespace oofem {
@@ -62,19 +67,47 @@ protected:
     FloatMatrix tangent;
     bool oldTangent = true;
 
+    /// Macro strain and homogenized stress of the last RVE solution, and number of time step it belongs to.
+    FloatArray cachedStrain, cachedStress;
+    int cachedStep = -1;
+
+    /// Reduced (Voigt) tangent, with macro strain and stress in which it was evaluated.
+    FloatMatrix reducedTangent;
+    FloatArray tangentStrain, tangentStress;
+
     /// Interface normal direction
     FloatArray mNormalDir;
 
     std :: string mInputFile;
 
 public:
-    StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile);
+    StructuralFE2MaterialStatus(int n, int rank, GaussPoint * g,  const std :: string & inputfile);
 
     EngngModel *giveRVE() const { return this->rve.get(); }
     PrescribedGradientHomogenization *giveBC();// { return this->bc; }
 
     void markOldTangent();
+    bool hasOldTangent() const { return this->oldTangent; }
     void computeTangent(TimeStep *tStep);
+    /// Sets the tangent computed elsewhere (e.g. on identical RVE), marks it as up to date.
+    void letTangentBe(const FloatMatrix &t);
+
+    /**
+     * Returns true if the given macro strain matches (within relative tolerance) the strain of
+     * the last RVE solution in given time step; the corresponding stress is then returned in answer.
+     */
+    bool giveCachedStress(FloatArray &answer, const FloatArray &strain, TimeStep *tStep, double tol) const;
+    /// Stores the macro strain and stress of the last RVE solution.
+    void setCachedResponse(const FloatArray &strain, const FloatArray &stress, TimeStep *tStep);
+    /// Invalidates the cached response and the reference state of the tangent.
+    void invalidateCache();
+    /// Stores the reduced tangent, evaluated in the current (temp) macro state, used to check if it can be reused.
+    void setReducedTangent(const FloatMatrix &d);
+    /**
+     * Checks if the response in current (temp) macro state is predicted by the stored tangent within
+     * given relative tolerance, in which case the RVE is considered to respond linearly and the tangent can be kept.
+     */
+    bool isTangentValid(double tol) const;
 
     /// Creates/Initiates the RVE problem.
     bool createRVE(int n, const std :: string &inputfile, int rank);
@@ -121,11 +154,41 @@ class StructuralFE2Material : public StructuralMaterial
 {
 protected:
     std :: string inputfile;
-    static int n;
+    /// Counter of created RVEs, used to give each RVE its own output file.
+    static std :: atomic< int >n;
     bool useNumTangent = false;
 
+    /**
+     * If set, the RVE response is assumed to be linear, and the same for all integration points,
+     * so the tangent is computed only once per time step and shared by all integration points.
+     */
+    bool sharedTangent = false;
+    /// Shared tangent, evaluated once per time step.
+    mutable StepSharedValue< FloatMatrix >sharedTangentValue;
+
+    /// Relative tolerance on macro strain for reusing the last RVE solution (zero to disable).
+    double cacheTol = 0.;
+    /// Relative tolerance on predicted stress for reusing the tangent (zero to disable).
+    double reuseTangentTol = 0.;
+    /// Cache statistics.
+    mutable std :: atomic< long >stressHits{0}, stressEvals{0}, tangentReuses{0}, tangentEvals{0};
+
+    /// Makes sure that tangent in given status is up to date, using the shared tangent if enabled.
+    void giveUpdatedTangent(StructuralFE2MaterialStatus *status, TimeStep *tStep) const;
+    /**
+     * Marks the tangent of given status as old, unless it is reused.
+     * @param status Material status, with temp strain and stress set.
+     */
+    void checkTangent(StructuralFE2MaterialStatus *status) const;
+    /**
+     * Updates the reference state of reused tangent, if the tangent was just recomputed.
+     * @param d Reduced tangent in full 6 component Voigt form.
+     */
+    void storeReducedTangent(StructuralFE2MaterialStatus *status, bool recomputed, const FloatMatrix &d) const;
+
 public:
     StructuralFE2Material(int n, Domain * d);
+    virtual ~StructuralFE2Material();
 
     void initializeFrom(InputRecord &ir) override;
     void giveInputRecord(DynamicInputRecord &input) override;
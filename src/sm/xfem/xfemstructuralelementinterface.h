@@ -55,6 +55,15 @@ public:
     /// Updates integration rule based on the triangulation.
     bool XfemElementInterface_updateIntegrationRule() override;
 
+    /**
+     * Computes a key describing the cut geometry of the element, consisting of
+     * the enriching items together with their nodal normal level sets and node
+     * enrichment markers. The key is used to decide if the current subdivision
+     * and integration rules can be kept.
+     * @return False if the subdivision can not be reused, e.g. if a crack tip lies inside the element.
+     */
+    bool giveSubdivisionKey(std :: vector< double > &oKey);
+
     MaterialStatus *giveClosestGP_MatStat(double &oClosestDist, std :: vector< std :: unique_ptr< IntegrationRule > > &iRules, const FloatArray &iCoord);
 
     double computeEffectiveSveSize(StructuralFE2MaterialStatus *iFe2Ms);
@@ -100,6 +109,11 @@ public:
     // Store element subdivision for postprocessing
     std :: vector< Triangle >mSubTri;
 
+    /// Key of the cut geometry that the current subdivision and integration rules were built for.
+    std :: vector< double >mSubdivisionKey;
+    /// True if the integration rules of the element correspond to mSubdivisionKey.
+    bool mSubdivisionKeyValid = false;
+
     /// VTK Interface
     void giveSubtriangulationCompositeExportData(std :: vector< ExportRegion > &vtkPieces, IntArray &primaryVarsToExport, IntArray &internalVarsToExport, IntArray cellVarsToExport, TimeStep *tStep);
 
@@ -0,0 +1,90 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef explicittransportproblem_h
+#define explicittransportproblem_h
+
+#include "tm/EngineeringModels/transienttransportproblem.h"
+
+///@name Input fields for ExplicitTransportProblem
+//@{
+#define _IFT_ExplicitTransportProblem_Name "explicittransport"
+#define _IFT_ExplicitTransportProblem_dtSafety "dtsafety" ///< Safety factor applied to estimated critical time step.
+#define _IFT_ExplicitTransportProblem_dtUpdate "dtupdate" ///< Number of steps after which the critical time step is re-estimated.
+//@}
+
+namespace oofem {
+/**
+ * Solves general (nonlinear) transient transport problems by explicit forward Euler
+ * time integration with lumped capacity matrix:
+ * @f[ C_L \frac{T_{n+1} - T_n}{\Delta t} = Q(t_n) - F(T_n) @f]
+ * The problem is solved element by element, no global sparse matrix is ever assembled.
+ *
+ * The time step is limited by the critical time step of the scheme, @f$ \Delta t_{cr} = 2/\lambda_{max} @f$,
+ * where the largest eigenvalue of @f$ C_L^{-1} K @f$ is estimated by Gershgorin theorem from
+ * absolute row sums of element conductivity matrices (again assembled element by element).
+ * The time step actually used is the minimum of prescribed deltat and the critical step reduced by safety factor.
+ */
+class ExplicitTransportProblem : public TransientTransportProblem
+{
+protected:
+    /// Safety factor applied to critical time step.
+    double dtSafety = 0.9;
+    /// Re-estimation period of critical time step (in number of steps).
+    int dtUpdate = 1;
+    /// Last estimated critical time step.
+    double criticalDeltaT = 0.;
+
+public:
+    ExplicitTransportProblem(int i, EngngModel *master=nullptr);
+
+    void solveYourselfAt(TimeStep *tStep) override;
+
+    void initializeFrom(InputRecord &ir) override;
+
+    /**
+     * Estimates the critical time step of the forward Euler scheme from Gershgorin bound
+     * of the largest eigenvalue of @f$ C_L^{-1} K @f$.
+     * @param capacity Lumped capacity.
+     * @param tStep Time step for which the conductivity is evaluated.
+     */
+    double estimateCriticalTimeStep(const FloatArray &capacity, TimeStep *tStep);
+
+    // identification
+    const char *giveInputRecordName() const { return _IFT_ExplicitTransportProblem_Name; }
+    const char *giveClassName() const override { return "ExplicitTransportProblem"; }
+};
+} // end namespace oofem
+#endif // explicittransportproblem_h
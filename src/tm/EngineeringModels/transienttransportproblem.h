@@ -50,7 +50,7 @@
 #define _IFT_TransientTransportProblem_initt "initt" ///< Initial time
 #define _IFT_TransientTransportProblem_dtFunction "dtfunction" ///< Function that determines size of time step.
 #define _IFT_TransientTransportProblem_prescribedTimes "prescribedtimes" ///< Discrete times for each time step.
-#define _IFT_TransientTransportProblem_keepTangent "keeptangent" ///< Fixes the tangent to be reused on each step.
+#define _IFT_TransientTransportProblem_keepTangent "keeptangent" ///< Fixes the tangent (and its factorization) to be reused on each step with the same time increment.
 #define _IFT_TransientTransportProblem_lumped "lumped" ///< Use of lumped "mass" matrix
 #define _IFT_TransientTransportProblem_exportFields "exportfields" ///< Fields to export for staggered problems.
 //@}
@@ -85,6 +85,8 @@ protected:
     double initT = 0.;
     double deltaT = 1.;
     bool keepTangent = false, hasTangent = false;
+    /// Time increment for which the current effective matrix was assembled.
+    double tangentDeltaT = 0.;
     bool lumped = false;
 
     IntArray exportFields;
@@ -104,6 +106,12 @@ public:
 
     virtual void applyIC();
 
+    /**
+     * Forces the reassembly of effective matrix in the next iteration, even if the tangent is kept.
+     * Should be invoked when the material parameters (e.g. conductivity or capacity) have changed.
+     */
+    void invalidateTangent() { this->hasTangent = false; }
+
     int requiresUnknownsDictionaryUpdate() override;
     int giveUnknownDictHashIndx(ValueModeType mode, TimeStep *tStep) override;
     void updateDomainLinks() override;
@@ -131,6 +139,16 @@ public:
     const char *giveInputRecordName() const { return _IFT_TransientTransportProblem_Name; }
     const char *giveClassName() const override { return "TransientTransportProblem"; }
     fMode giveFormulation() override { return TL; }
+
+protected:
+    /// Reads the fields to be exported and registers them in field manager.
+    void initializeExportFields(InputRecord &ir);
+    /**
+     * Assembles the effective matrix @f$ K_{eff} = \alpha K + C/\Delta t @f$ into receiver's effective matrix.
+     * When the tangent is kept, the matrix (including its factorization) is reused as long
+     * as the time increment does not change.
+     */
+    void assembleEffectiveMatrix(SparseMtrx &mat, TimeStep *tStep, Domain *d);
 };
 } // end namespace oofem
 #endif // transienttransportproblem_h
@@ -124,6 +124,19 @@ public:
     virtual void storeWeightTemperatureProductVolume(Element *element, TimeStep *tStep);
     /// Perform averaging on a master CemhydMatStatus.
     virtual void averageTemperature();
+    /**
+     * Advances hydration of all microstructures of the receiver to the target time of given step,
+     * using averaged temperatures from the last equilibrated state. The microstructures are independent
+     * (each has own voxel arrays and random number generator state), so they are processed concurrently
+     * when OpenMP is enabled, with results identical to the serial evaluation.
+     * The heat power is then only retrieved in computeInternalSourceVector.
+     */
+    virtual void updateHydration(TimeStep *tStep);
+    /**
+     * Advances hydration of all CEMHYD3D materials of given domain to the target time of given step.
+     * Called by transport problems before the balance equations (heat sources) are assembled.
+     */
+    static void updateHydrationOfDomain(Domain *d, TimeStep *tStep);
 
     void initializeFrom(InputRecord &ir) override;
     /// Use different methods to evaluate material parameters